@@ -0,0 +1,88 @@
+#include <GraphBLAS.h>
+#include <iostream>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+#include <chrono>
+#include <functional>
+#include "graphblas/ktruss.hpp"
+#include "graphblas/utils.hpp"
+
+// Runs `algo`, writes its time and returns the number of edges and the sum of values of the result
+static std::pair<GrB_Index, uint64_t> run(std::ofstream &csv, const std::string &name, const std::string &dataset,
+                                          const std::string &k, const std::function<GrB_Matrix()> &algo)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    GrB_Matrix result = algo();
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = end - start;
+
+    GrB_Index nvals;
+    uint64_t sum = 0;
+    GrB_Matrix_nvals(&nvals, result);
+    GrB_Matrix_reduce_UINT64(&sum, nullptr, GrB_PLUS_MONOID_UINT64, result, nullptr);
+    GrB_Matrix_free(&result);
+
+    std::cout << name << " k = " << k << ": " << nvals / 2 << " edges, " << elapsed.count() << " s" << std::endl;
+    csv << name << "," << dataset << "," << k << "," << elapsed.count() << std::endl;
+    return {nvals, sum};
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <datasets_folder> <num_iters>" << std::endl;
+        return 1;
+    }
+    std::string folder = argv[1];
+    int num_iters = std::stoi(argv[2]);
+
+    std::vector<uint64_t> k_list = {3, 4, 5};
+
+    std::ofstream csv("ktruss_bench.csv");
+    csv << "algo,dataset,k,time" << std::endl;
+    for (const auto &entry : std::filesystem::directory_iterator(folder))
+    {
+        if (entry.is_regular_file() && entry.path().extension() == ".txt")
+        {
+            std::string dataset = entry.path().filename().string();
+            std::string dataset_path = entry.path().string();
+            std::cout << "\nRunning k-truss benchmarks for dataset: " << dataset << std::endl;
+
+            GrB_init(GrB_NONBLOCKING);
+            GrB_Matrix A = graphblas_utils::load_graph(dataset_path, false);
+            for (int iter = 0; iter < num_iters; ++iter)
+            {
+                for (uint64_t k : k_list)
+                {
+                    auto incremental = run(csv, "GB_KTruss_Incremental", dataset, std::to_string(k),
+                                           [&]
+                                           { return ktruss_graphblas::ktruss(A, k); });
+                    auto naive = run(csv, "GB_KTruss_Naive", dataset, std::to_string(k),
+                                     [&]
+                                     { return ktruss_graphblas::ktruss_naive(A, k); });
+                    if (incremental != naive)
+                    {
+                        std::cerr << "Warning: incremental and naive " << k << "-truss differ on " << dataset << std::endl;
+                    }
+                }
+
+                auto incremental = run(csv, "GB_TrussDecomposition_Incremental", dataset, "all",
+                                       [&]
+                                       { return ktruss_graphblas::truss_decomposition(A); });
+                auto naive = run(csv, "GB_TrussDecomposition_Naive", dataset, "all",
+                                 [&]
+                                 { return ktruss_graphblas::truss_decomposition_naive(A); });
+                if (incremental != naive)
+                {
+                    std::cerr << "Warning: incremental and naive truss decomposition differ on " << dataset << std::endl;
+                }
+            }
+            GrB_Matrix_free(&A);
+            GrB_finalize();
+        }
+    }
+    csv.close();
+    return 0;
+}
@@ -0,0 +1,63 @@
+#include <GraphBLAS.h>
+#include <iostream>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+#include <chrono>
+#include "graphblas/graph_metrics.hpp"
+#include "graphblas/utils.hpp"
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <datasets_folder> <num_iters>" << std::endl;
+        return 1;
+    }
+    std::string folder = argv[1];
+    int num_iters = std::stoi(argv[2]);
+
+    std::ofstream csv("metrics_bench.csv");
+    csv << "algo,dataset,time,sources_expanded,batches,diameter,radius" << std::endl;
+    for (const auto &entry : std::filesystem::directory_iterator(folder))
+    {
+        if (entry.is_regular_file() && entry.path().extension() == ".txt")
+        {
+            std::string dataset = entry.path().filename().string();
+            std::string dataset_path = entry.path().string();
+            std::cout << "\nRunning metrics benchmarks for dataset: " << dataset << std::endl;
+
+            GrB_init(GrB_NONBLOCKING);
+            GrB_Matrix A = graphblas_utils::load_graph(dataset_path, false);
+            for (int iter = 0; iter < num_iters; ++iter)
+            {
+                auto start = std::chrono::high_resolution_clock::now();
+                auto exact = metrics_graphblas::exhaustive(A);
+                auto end = std::chrono::high_resolution_clock::now();
+                std::chrono::duration<double> elapsed = end - start;
+
+                auto start_bd = std::chrono::high_resolution_clock::now();
+                auto bounded = metrics_graphblas::bounding_diameters(A);
+                auto end_bd = std::chrono::high_resolution_clock::now();
+                std::chrono::duration<double> elapsed_bd = end_bd - start_bd;
+
+                if (exact.diameter != bounded.diameter || exact.radius != bounded.radius)
+                {
+                    std::cerr << "Warning: bounding diameters disagrees with exhaustive BFS on " << dataset << std::endl;
+                }
+                std::cout << "Iteration " << iter + 1 << ": diameter " << bounded.diameter << ", radius " << bounded.radius
+                          << ", sources " << bounded.sources_expanded << "/" << exact.sources_expanded
+                          << ", " << elapsed_bd.count() << " s vs " << elapsed.count() << " s" << std::endl;
+
+                csv << "GB_Exhaustive," << dataset << "," << elapsed.count() << "," << exact.sources_expanded << ","
+                    << exact.batches << "," << exact.diameter << "," << exact.radius << std::endl;
+                csv << "GB_BoundingDiameters," << dataset << "," << elapsed_bd.count() << "," << bounded.sources_expanded << ","
+                    << bounded.batches << "," << bounded.diameter << "," << bounded.radius << std::endl;
+            }
+            GrB_Matrix_free(&A);
+            GrB_finalize();
+        }
+    }
+    csv.close();
+    return 0;
+}
@@ -10,12 +10,15 @@
 #include "graphblas/utils.hpp"
 #include "spla/utils.hpp"
 #include "spla/msbfs.hpp"
+#include "native/msbfs.hpp"
+#include "native/utils.hpp"
+#include "scaling.hpp"
 
 int main(int argc, char *argv[])
 {
     if (argc < 3)
     {
-        std::cerr << "Usage: " << argv[0] << " <datasets_folder> <num_iters>" << std::endl;
+        std::cerr << "Usage: " << argv[0] << " <datasets_folder> <num_iters> [threads,...] [default|interleave|local|first_touch]" << std::endl;
         return 1;
     }
     const int SEED = 42;
@@ -23,11 +26,15 @@ int main(int argc, char *argv[])
 
     std::string folder = argv[1];
     int num_iters = std::stoi(argv[2]);
+    // Without a thread list every variant runs once with the libraries' default thread count.
+    std::vector<int> thread_list = argc > 3 ? scaling::parse_thread_list(argv[3]) : std::vector<int>{0};
+    scaling::NumaPolicy numa = argc > 4 ? scaling::parse_numa_policy(argv[4]) : scaling::NumaPolicy::Default;
+    scaling::apply_numa_policy(numa);
 
     std::vector<int> n_start_list = {4, 8, 16, 32, 64};
 
     std::ofstream csv("msbfs_bench.csv");
-    csv << "algo,dataset,n_start_vert,time" << std::endl;
+    csv << "algo,dataset,n_start_vert,time,threads,numa,index_width" << std::endl;
     for (const auto &entry : std::filesystem::directory_iterator(folder))
     {
         if (entry.is_regular_file() && entry.path().extension() == ".txt")
@@ -38,40 +45,70 @@ int main(int argc, char *argv[])
 
             GrB_init(GrB_NONBLOCKING);
             GrB_Matrix A = graphblas_utils::load_graph(dataset_path, false);
+            native_utils::Graph native_A = native_utils::load_graph(dataset_path, false);
+            int native_width = native_utils::index_width(native_A);
+            std::cout << "Native index width: " << native_width << " bit" << std::endl;
             GrB_Index n;
             GrB_Matrix_nrows(&n, A);
             std::vector<GrB_Index> all_vertices(n);
-            for (GrB_Index i = 0; i < n; ++i)
+            for (int nthreads : thread_list)
             {
-                all_vertices[i] = i;
-            }
-            for (int n_start : n_start_list)
-            {
-                if (n_start > n)
-                    continue;
-                std::cout << "N start = " << n_start << std::endl;
-                for (int iter = 0; iter < num_iters; ++iter)
+                scaling::set_num_threads(nthreads);
+                graphblas_utils::set_num_threads(nthreads);
+                if (numa == scaling::NumaPolicy::FirstTouch)
                 {
-                    std::cout << "." << std::flush;
-                    std::shuffle(all_vertices.begin(), all_vertices.end(), rng);
-                    std::vector<GrB_Index> starts(all_vertices.begin(), all_vertices.begin() + n_start);
+                    graphblas_utils::first_touch_copy(&A);
+                    native_utils::first_touch_copy(native_A);
+                }
+                std::string run = "," + std::to_string(scaling::effective_threads(nthreads)) + "," + scaling::to_string(numa);
+                std::string native_run = "," + std::to_string(scaling::native_threads(nthreads)) + "," + scaling::to_string(numa);
+                std::cout << "Threads = " << scaling::effective_threads(nthreads) << std::endl;
 
-                    auto start = std::chrono::high_resolution_clock::now();
-                    GrB_Matrix parent = msbfs(A, starts);
-                    auto end = std::chrono::high_resolution_clock::now();
-                    std::chrono::duration<double> elapsed = end - start;
+                // Same start vertices for every thread count
+                rng.seed(SEED);
+                for (GrB_Index i = 0; i < n; ++i)
+                {
+                    all_vertices[i] = i;
+                }
+                for (int n_start : n_start_list)
+                {
+                    if (n_start > n)
+                        continue;
+                    std::cout << "N start = " << n_start << std::endl;
+                    for (int iter = 0; iter < num_iters; ++iter)
+                    {
+                        std::cout << "." << std::flush;
+                        std::shuffle(all_vertices.begin(), all_vertices.end(), rng);
+                        std::vector<GrB_Index> starts(all_vertices.begin(), all_vertices.begin() + n_start);
+
+                        auto start = std::chrono::high_resolution_clock::now();
+                        GrB_Matrix parent = msbfs(A, starts);
+                        auto end = std::chrono::high_resolution_clock::now();
+                        std::chrono::duration<double> elapsed = end - start;
+
+                        auto start_native = std::chrono::high_resolution_clock::now();
+                        auto native_parents = msbfs_native::msbfs(native_A, starts);
+                        auto end_native = std::chrono::high_resolution_clock::now();
+                        std::chrono::duration<double> elapsed_native = end_native - start_native;
 
-                    csv << "GB_MSBFS," << dataset << "," << n_start << "," << elapsed.count() << std::endl;
-                    GrB_Matrix_free(&parent);
+                        auto start_levels = std::chrono::high_resolution_clock::now();
+                        auto native_levels = msbfs_native::msbfs_levels(native_A, starts);
+                        auto end_levels = std::chrono::high_resolution_clock::now();
+                        std::chrono::duration<double> elapsed_levels = end_levels - start_levels;
+
+                        csv << "GB_MSBFS," << dataset << "," << n_start << "," << elapsed.count() << run << ",64" << std::endl;
+                        csv << "NATIVE_MSBFS," << dataset << "," << n_start << "," << elapsed_native.count() << native_run << "," << native_width << std::endl;
+                        csv << "NATIVE_MSBFS_LEVELS," << dataset << "," << n_start << "," << elapsed_levels.count() << native_run << "," << native_width << std::endl;
+                        GrB_Matrix_free(&parent);
+                    }
+                    std::cout << std::endl;
                 }
-                std::cout << std::endl;
             }
             GrB_Matrix_free(&A);
             GrB_finalize();
         }
     }
 
-    rng.seed(SEED);
     for (const auto &entry : std::filesystem::directory_iterator(folder))
     {
         if (entry.is_regular_file() && entry.path().extension() == ".txt")
@@ -82,6 +119,13 @@ int main(int argc, char *argv[])
             auto B = spla_utils::load_graph(dataset_path, false);
             auto n = B->get_n_rows();
             std::vector<int> all_vertices(n);
+
+            // SPLA exposes no thread count, so it runs once outside the sweep
+            // with threads = 0 and is left out of the scaling tables
+            std::string run = ",0," + scaling::to_string(numa);
+
+            // Same start vertices as the GraphBLAS run
+            rng.seed(SEED);
             for (int i = 0; i < n; ++i)
             {
                 all_vertices[i] = i;
@@ -108,13 +152,14 @@ int main(int argc, char *argv[])
                     std::chrono::duration<double> elapsed_gpu = end_gpu - start_gpu;
                     // spla_utils::print_matrix(parents);
 
-                    csv << "SPLA_MSBFS," << dataset << "," << n_start << "," << elapsed.count() << std::endl;
-                    csv << "SPLAGPU_MSBFS," << dataset << "," << n_start << "," << elapsed_gpu.count() << std::endl;
+                    csv << "SPLA_MSBFS," << dataset << "," << n_start << "," << elapsed.count() << run << ",32" << std::endl;
+                    csv << "SPLAGPU_MSBFS," << dataset << "," << n_start << "," << elapsed_gpu.count() << run << ",32" << std::endl;
                 }
                 std::cout << std::endl;
             }
         }
     }
+
     csv.close();
     return 0;
 }
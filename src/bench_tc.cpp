@@ -5,58 +5,88 @@
 #include <vector>
 #include "graphblas/triangles_counting.hpp"
 #include "spla/triangles_counting.hpp"
+#include "native/triangles_counting.hpp"
+#include "scaling.hpp"
 
 int main(int argc, char* argv[]) {
     if (argc < 3) {
-        std::cerr << "Usage: " << argv[0] << " <datasets_folder> <num_iters>" << std::endl;
+        std::cerr << "Usage: " << argv[0] << " <datasets_folder> <num_iters> [threads,...] [default|interleave|local|first_touch]" << std::endl;
         return 1;
     }
     std::string folder = argv[1];
     int num_iters = std::stoi(argv[2]);
+    // Without a thread list every variant runs once with the libraries' default thread count.
+    std::vector<int> thread_list = argc > 3 ? scaling::parse_thread_list(argv[3]) : std::vector<int>{0};
+    scaling::NumaPolicy numa = argc > 4 ? scaling::parse_numa_policy(argv[4]) : scaling::NumaPolicy::Default;
+    bool first_touch = numa == scaling::NumaPolicy::FirstTouch;
+    scaling::apply_numa_policy(numa);
+
     std::vector<std::string> algos = {"Burkhardt", "Sandia", "SPLA_Burkhardt"};
     std::ofstream csv("bench_tc.csv");
-    csv << "algo,dataset,time_of_iter" << std::endl;
+    csv << "algo,dataset,time_of_iter,threads,numa,index_width" << std::endl;
     for (const auto& entry : std::filesystem::directory_iterator(folder)) {
         if (entry.is_regular_file() && entry.path().extension() == ".txt") {
             std::string dataset = entry.path().filename().string();
             std::string dataset_path = entry.path().string();
             std::cout << "\nRunning benchmarks for dataset: " << dataset << std::endl;
 
+            // SPLA exposes no thread count, so it runs once outside the sweep
+            // with threads = 0 and is left out of the scaling tables
+            std::string spla_run = ",0," + scaling::to_string(numa);
+
             // SPLA GPU Burkhardt
             auto times_splagpu_burkhardt = tc_spla::benchmark(dataset_path.c_str(), false, num_iters, true);
             for (const auto& t : times_splagpu_burkhardt) {
-                csv << "SPLAGPU_Burkhardt," << dataset << "," << t << std::endl;
+                csv << "SPLAGPU_Burkhardt," << dataset << "," << t << spla_run << ",32" << std::endl;
             }
             // SPLA GPU Sandia
             auto times_splagpu_sandia = tc_spla::benchmark(dataset_path.c_str(), true, num_iters, true);
             for (const auto& t : times_splagpu_sandia) {
-                csv << "SPLAGPU_Sandia," << dataset << "," << t << std::endl;
+                csv << "SPLAGPU_Sandia," << dataset << "," << t << spla_run << ",32" << std::endl;
             }
 
             // SPLA Burkhardt
             auto times_spla_burkhardt = tc_spla::benchmark(dataset_path.c_str(), false, num_iters, false);
             for (const auto& t : times_spla_burkhardt) {
-                csv << "SPLA_Burkhardt," << dataset << "," << t << std::endl;
+                csv << "SPLA_Burkhardt," << dataset << "," << t << spla_run << ",32" << std::endl;
             }
             // SPLA Sandia
             auto times_spla_sandia = tc_spla::benchmark(dataset_path.c_str(), true, num_iters, false);
             for (const auto& t : times_spla_sandia) {
-                csv << "SPLA_Sandia," << dataset << "," << t << std::endl;
+                csv << "SPLA_Sandia," << dataset << "," << t << spla_run << ",32" << std::endl;
             }
 
-            // GraphBLAS Burkhardt
-            auto times_burkhardt = tc_graphblas::benchmark(dataset_path.c_str(), false, num_iters);
-            for (const auto& t : times_burkhardt) {
-                csv << "GB_Burkhardt," << dataset << "," << t << std::endl;
+            for (int nthreads : thread_list) {
+                scaling::set_num_threads(nthreads);
+                std::string run = "," + std::to_string(scaling::effective_threads(nthreads)) + "," + scaling::to_string(numa);
+                std::string native_run = "," + std::to_string(scaling::native_threads(nthreads)) + "," + scaling::to_string(numa);
+                std::cout << "Threads = " << scaling::effective_threads(nthreads) << std::endl;
+
+                // GraphBLAS Burkhardt
+                auto times_burkhardt = tc_graphblas::benchmark(dataset_path.c_str(), false, num_iters, nthreads, first_touch);
+                for (const auto& t : times_burkhardt) {
+                    csv << "GB_Burkhardt," << dataset << "," << t << run << ",64" << std::endl;
+                }
+                // GraphBLAS Sandia
+                auto times_sandia = tc_graphblas::benchmark(dataset_path.c_str(), true, num_iters, nthreads, first_touch);
+                for (const auto& t : times_sandia) {
+                    csv << "GB_Sandia," << dataset << "," << t << run << ",64" << std::endl;
+                }
+
+                // Native Burkhardt, index width picked by the loader
+                int width = 0;
+                auto times_native_burkhardt = tc_native::benchmark(dataset_path.c_str(), false, num_iters, width, first_touch);
+                for (const auto& t : times_native_burkhardt) {
+                    csv << "NATIVE_Burkhardt," << dataset << "," << t << native_run << "," << width << std::endl;
+                }
+                // Native Sandia
+                auto times_native_sandia = tc_native::benchmark(dataset_path.c_str(), true, num_iters, width, first_touch);
+                for (const auto& t : times_native_sandia) {
+                    csv << "NATIVE_Sandia," << dataset << "," << t << native_run << "," << width << std::endl;
+                }
             }
-            // GraphBLAS Sandia
-            auto times_sandia = tc_graphblas::benchmark(dataset_path.c_str(), true, num_iters);
-            for (const auto& t : times_sandia) {
-                csv << "GB_Sandia," << dataset << "," << t << std::endl;
-            } 
         }
     }
     csv.close();
     return 0;
 }
-
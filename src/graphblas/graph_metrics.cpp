@@ -0,0 +1,231 @@
+#include "graph_metrics.hpp"
+#include "msbfs.hpp"
+#include <algorithm>
+
+namespace metrics_graphblas
+{
+    // Number of neighbours other than the vertex itself
+    static std::vector<uint64_t> degrees(GrB_Matrix A, GrB_Index n)
+    {
+        GrB_Matrix C;
+        GrB_Matrix_new(&C, GrB_UINT64, n, n);
+        GrB_Matrix_select_INT64(C, GrB_NULL, GrB_NULL, GrB_OFFDIAG, A, 0, GrB_NULL);
+
+        GrB_Vector d;
+        GrB_Vector_new(&d, GrB_UINT64, n);
+        GrB_Matrix_reduce_Monoid(d, GrB_NULL, GrB_NULL, GrB_PLUS_MONOID_UINT64, C, GrB_NULL);
+        GrB_Matrix_free(&C);
+
+        GrB_Index nvals;
+        GrB_Vector_nvals(&nvals, d);
+        std::vector<GrB_Index> I(nvals);
+        std::vector<uint64_t> X(nvals);
+        GrB_Vector_extractTuples_UINT64(I.data(), X.data(), &nvals, d);
+        GrB_Vector_free(&d);
+
+        std::vector<uint64_t> deg(n, 0);
+        for (GrB_Index k = 0; k < nvals; ++k)
+        {
+            deg[I[k]] = X[k];
+        }
+        return deg;
+    }
+
+    // BFS levels from `sources` as (source index, vertex, level) tuples,
+    // returns the eccentricity of every source.
+    static std::vector<uint64_t> expand(GrB_Matrix A, const std::vector<GrB_Index> &sources,
+                                        std::vector<GrB_Index> &rows, std::vector<GrB_Index> &cols,
+                                        std::vector<int32_t> &levels)
+    {
+        GrB_Matrix L = msbfs_levels(A, sources);
+        GrB_Index nvals;
+        GrB_Matrix_nvals(&nvals, L);
+        rows.resize(nvals);
+        cols.resize(nvals);
+        levels.resize(nvals);
+        GrB_Matrix_extractTuples_INT32(rows.data(), cols.data(), levels.data(), &nvals, L);
+        GrB_Matrix_free(&L);
+
+        std::vector<uint64_t> ecc(sources.size(), 0);
+        for (GrB_Index k = 0; k < nvals; ++k)
+        {
+            ecc[rows[k]] = std::max<uint64_t>(ecc[rows[k]], levels[k]);
+        }
+        return ecc;
+    }
+
+    GraphMetrics bounding_diameters(GrB_Matrix A, GrB_Index max_batch)
+    {
+        GrB_Index n;
+        GrB_Matrix_nrows(&n, A);
+
+        GraphMetrics m;
+        m.ecc_lower.assign(n, 0);
+        m.ecc_upper.assign(n, ECC_UNKNOWN);
+        if (n == 0)
+        {
+            return m;
+        }
+        auto &lower = m.ecc_lower;
+        auto &upper = m.ecc_upper;
+
+        // Isolated vertices are known (eccentricity 0) and left out of the
+        // diameter and radius, as are vertices that can no longer change them
+        const std::vector<uint64_t> deg = degrees(A, n);
+        std::vector<GrB_Index> candidates, by_upper, by_lower, sources, rows, cols;
+        std::vector<int32_t> levels;
+        std::vector<bool> picked(n, false);
+        bool any_edge = false;
+        for (GrB_Index v = 0; v < n; ++v)
+        {
+            if (deg[v] == 0)
+            {
+                upper[v] = 0;
+            }
+            any_edge |= deg[v] > 0;
+        }
+        if (!any_edge)
+        {
+            return m;
+        }
+
+        // Like iFUB, start from the highest degree vertex alone
+        GrB_Index batch = 1;
+        while (true)
+        {
+            uint64_t d_low = 0, d_up = 0, r_low = ECC_UNKNOWN, r_up = ECC_UNKNOWN;
+            for (GrB_Index v = 0; v < n; ++v)
+            {
+                if (deg[v] == 0)
+                {
+                    continue;
+                }
+                d_low = std::max(d_low, lower[v]);
+                d_up = std::max(d_up, upper[v]);
+                r_low = std::min(r_low, lower[v]);
+                r_up = std::min(r_up, upper[v]);
+            }
+            if (d_low == d_up && r_low == r_up)
+            {
+                m.diameter = d_low;
+                m.radius = r_low;
+                break;
+            }
+
+            // Takes & Kosters: only a vertex whose bounds still straddle the
+            // current diameter or radius bound can tighten either of them
+            candidates.clear();
+            for (GrB_Index v = 0; v < n; ++v)
+            {
+                if (lower[v] < upper[v] && (upper[v] > d_low || lower[v] < r_up))
+                {
+                    candidates.push_back(v);
+                }
+            }
+
+            // Alternate the largest upper bound (diameter side) and the smallest
+            // lower bound (radius side), ties go to the higher degree.
+            GrB_Index k = std::min<GrB_Index>(batch, candidates.size());
+            by_upper = candidates;
+            by_lower = candidates;
+            std::partial_sort(by_upper.begin(), by_upper.begin() + k, by_upper.end(),
+                              [&](GrB_Index a, GrB_Index b)
+                              { return upper[a] != upper[b] ? upper[a] > upper[b] : deg[a] > deg[b]; });
+            std::partial_sort(by_lower.begin(), by_lower.begin() + k, by_lower.end(),
+                              [&](GrB_Index a, GrB_Index b)
+                              { return lower[a] != lower[b] ? lower[a] < lower[b] : deg[a] > deg[b]; });
+            sources.clear();
+            for (GrB_Index i = 0; sources.size() < k; ++i)
+            {
+                for (GrB_Index v : {by_upper[i], by_lower[i]})
+                {
+                    if (sources.size() < k && !picked[v])
+                    {
+                        picked[v] = true;
+                        sources.push_back(v);
+                    }
+                }
+            }
+
+            const std::vector<uint64_t> ecc = expand(A, sources, rows, cols, levels);
+            m.sources_expanded += sources.size();
+            ++m.batches;
+
+            GrB_Index resolved = 0;
+            for (GrB_Index t = 0; t < rows.size(); ++t)
+            {
+                const GrB_Index w = cols[t];
+                const uint64_t e = ecc[rows[t]];
+                const uint64_t d = levels[t];
+                if (lower[w] == upper[w])
+                {
+                    continue;
+                }
+                lower[w] = std::max({lower[w], e - d, d});
+                upper[w] = std::min(upper[w], e + d);
+                resolved += lower[w] == upper[w];
+            }
+
+            // Grow the batch while the bounds prune little beyond the sources
+            // themselves, shrink it back once they start resolving whole regions.
+            if (resolved < 2 * sources.size())
+            {
+                batch = std::min(2 * batch, max_batch);
+            }
+            else
+            {
+                batch = std::max<GrB_Index>(batch / 2, 1);
+            }
+        }
+        return m;
+    }
+
+    GraphMetrics exhaustive(GrB_Matrix A, GrB_Index batch)
+    {
+        GrB_Index n;
+        GrB_Matrix_nrows(&n, A);
+
+        GraphMetrics m;
+        m.ecc_lower.assign(n, 0);
+        const std::vector<uint64_t> deg = degrees(A, n);
+        std::vector<GrB_Index> sources, rows, cols;
+        std::vector<int32_t> levels;
+        for (GrB_Index v = 0; v < n;)
+        {
+            // Isolated vertices have eccentricity 0 and are not expanded
+            sources.clear();
+            for (; v < n && sources.size() < batch; ++v)
+            {
+                if (deg[v] > 0)
+                {
+                    sources.push_back(v);
+                }
+            }
+            if (sources.empty())
+            {
+                break;
+            }
+            const std::vector<uint64_t> ecc = expand(A, sources, rows, cols, levels);
+            for (GrB_Index i = 0; i < sources.size(); ++i)
+            {
+                m.ecc_lower[sources[i]] = ecc[i];
+            }
+            m.sources_expanded += sources.size();
+            ++m.batches;
+        }
+        m.ecc_upper = m.ecc_lower;
+        if (m.sources_expanded > 0)
+        {
+            m.radius = ECC_UNKNOWN;
+            for (GrB_Index v = 0; v < n; ++v)
+            {
+                if (deg[v] > 0)
+                {
+                    m.diameter = std::max(m.diameter, m.ecc_lower[v]);
+                    m.radius = std::min(m.radius, m.ecc_lower[v]);
+                }
+            }
+        }
+        return m;
+    }
+}
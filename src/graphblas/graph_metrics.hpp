@@ -0,0 +1,36 @@
+#pragma once
+#include <GraphBLAS.h>
+#include <vector>
+#include <cstdint>
+#include <limits>
+
+namespace metrics_graphblas
+{
+    // Eccentricities are taken inside the connected component of each vertex.
+    // The diameter and radius are the max / min of them over vertices with at
+    // least one neighbour: isolated ids (e.g. gaps in SNAP ids) get
+    // eccentricity 0 and would otherwise always make the radius 0.
+    const uint64_t ECC_UNKNOWN = std::numeric_limits<uint64_t>::max();
+
+    struct GraphMetrics
+    {
+        uint64_t diameter = 0;
+        uint64_t radius = 0;
+        // Bounds per vertex, equal when the eccentricity is known exactly
+        std::vector<uint64_t> ecc_lower;
+        std::vector<uint64_t> ecc_upper;
+        uint64_t sources_expanded = 0;
+        uint64_t batches = 0;
+    };
+
+    // Bounding diameters (Takes & Kosters) over batched msbfs_levels:
+    // each round BFS-es a batch of vertices that can still tighten the
+    // diameter or radius bound, alternating the largest upper and the
+    // smallest lower eccentricity bound, and tightens
+    // the bounds of every reached vertex. The batch grows up to max_batch
+    // while rounds resolve fewer vertices than they expand.
+    GraphMetrics bounding_diameters(GrB_Matrix A, GrB_Index max_batch = 64);
+
+    // Reference: msbfs_levels from every vertex in chunks of `batch`.
+    GraphMetrics exhaustive(GrB_Matrix A, GrB_Index batch = 64);
+}
@@ -0,0 +1,136 @@
+#include "ktruss.hpp"
+
+namespace ktruss_graphblas
+{
+    // S<C> = C * C, edges without triangles are kept with an explicit 0
+    static GrB_Matrix support(GrB_Matrix C)
+    {
+        GrB_Index n;
+        GrB_Matrix_nrows(&n, C);
+
+        GrB_Matrix S;
+        GrB_Matrix_new(&S, GrB_UINT64, n, n);
+        GrB_Matrix_assign_UINT64(S, C, GrB_NULL, 0, GrB_ALL, n, GrB_ALL, n, GrB_DESC_S);
+        GrB_mxm(S, C, GrB_PLUS_UINT64, GxB_PLUS_PAIR_UINT64, C, C, GrB_DESC_S);
+        return S;
+    }
+
+    static GrB_Matrix initial_support(GrB_Matrix A)
+    {
+        GrB_Index n;
+        GrB_Matrix_nrows(&n, A);
+
+        // Self loops are not edges of any triangle
+        GrB_Matrix C;
+        GrB_Matrix_new(&C, GrB_BOOL, n, n);
+        GrB_Matrix_select_INT64(C, GrB_NULL, GrB_NULL, GrB_OFFDIAG, A, 0, GrB_NULL);
+
+        GrB_Matrix S = support(C);
+        GrB_Matrix_free(&C);
+        return S;
+    }
+
+    // Removes the edges of *S with support below min_support, records them in
+    // `truss` with value `level` when given, and returns how many were removed.
+    static GrB_Index peel(GrB_Matrix *S, uint64_t min_support, GrB_Matrix truss, uint64_t level, bool incremental)
+    {
+        GrB_Index n;
+        GrB_Matrix_nrows(&n, *S);
+
+        GrB_Matrix K, R;
+        GrB_Matrix_new(&K, GrB_UINT64, n, n);
+        GrB_Matrix_new(&R, GrB_UINT64, n, n);
+        GrB_Matrix_select_UINT64(R, GrB_NULL, GrB_NULL, GrB_VALUELT_UINT64, *S, min_support, GrB_NULL);
+
+        GrB_Index removed;
+        GrB_Matrix_nvals(&removed, R);
+        if (removed == 0)
+        {
+            GrB_Matrix_free(&K);
+            GrB_Matrix_free(&R);
+            return 0;
+        }
+
+        GrB_Matrix_select_UINT64(K, GrB_NULL, GrB_NULL, GrB_VALUEGE_UINT64, *S, min_support, GrB_NULL);
+        if (truss != GrB_NULL)
+        {
+            GrB_Matrix_assign_UINT64(truss, R, GrB_NULL, level, GrB_ALL, n, GrB_ALL, n, GrB_DESC_S);
+        }
+
+        if (incremental)
+        {
+            // A kept edge (u, w) loses every triangle (u, x, w) with (u, x) or
+            // (x, w) removed: K<K> -= R * C + K * R, where C = K + R is *S.
+            GrB_mxm(K, K, GrB_MINUS_UINT64, GxB_PLUS_PAIR_UINT64, R, *S, GrB_DESC_S);
+            GrB_mxm(K, K, GrB_MINUS_UINT64, GxB_PLUS_PAIR_UINT64, K, R, GrB_DESC_S);
+        }
+        else
+        {
+            GrB_Matrix recomputed = support(K);
+            GrB_Matrix_free(&K);
+            K = recomputed;
+        }
+
+        GrB_Matrix_free(&R);
+        GrB_Matrix_free(S);
+        *S = K;
+        return removed;
+    }
+
+    static GrB_Matrix peel_to_ktruss(GrB_Matrix A, uint64_t k, bool incremental)
+    {
+        uint64_t min_support = k > 2 ? k - 2 : 0;
+        GrB_Matrix S = initial_support(A);
+        while (peel(&S, min_support, GrB_NULL, 0, incremental) > 0)
+        {
+        }
+        return S;
+    }
+
+    static GrB_Matrix decompose(GrB_Matrix A, bool incremental)
+    {
+        GrB_Index n;
+        GrB_Matrix_nrows(&n, A);
+
+        GrB_Matrix truss;
+        GrB_Matrix_new(&truss, GrB_UINT64, n, n);
+
+        // Peel the k-truss out of the (k-1)-truss, edges removed on the way have truss number k - 1
+        GrB_Matrix S = initial_support(A);
+        for (uint64_t k = 3;; ++k)
+        {
+            while (peel(&S, k - 2, truss, k - 1, incremental) > 0)
+            {
+            }
+
+            GrB_Index nvals;
+            GrB_Matrix_nvals(&nvals, S);
+            if (nvals == 0)
+            {
+                break;
+            }
+        }
+        GrB_Matrix_free(&S);
+        return truss;
+    }
+
+    GrB_Matrix ktruss(GrB_Matrix A, uint64_t k)
+    {
+        return peel_to_ktruss(A, k, true);
+    }
+
+    GrB_Matrix ktruss_naive(GrB_Matrix A, uint64_t k)
+    {
+        return peel_to_ktruss(A, k, false);
+    }
+
+    GrB_Matrix truss_decomposition(GrB_Matrix A)
+    {
+        return decompose(A, true);
+    }
+
+    GrB_Matrix truss_decomposition_naive(GrB_Matrix A)
+    {
+        return decompose(A, false);
+    }
+}
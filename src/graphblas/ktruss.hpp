@@ -0,0 +1,20 @@
+#pragma once
+#include <GraphBLAS.h>
+#include <cstdint>
+
+namespace ktruss_graphblas
+{
+    // k-truss of the symmetric adjacency A: the largest subgraph where every
+    // edge lies in at least k - 2 triangles. Returns the edges with their
+    // support (UINT64). After each pruning round only the supports touched by
+    // the removed edges are updated: S<S> -= R * C + S * R.
+    GrB_Matrix ktruss(GrB_Matrix A, uint64_t k);
+
+    // Same result, recomputing S<C> = C * C after every pruning round.
+    GrB_Matrix ktruss_naive(GrB_Matrix A, uint64_t k);
+
+    // Truss number (largest k whose k-truss contains the edge) of every edge of A.
+    GrB_Matrix truss_decomposition(GrB_Matrix A);
+
+    GrB_Matrix truss_decomposition_naive(GrB_Matrix A);
+}
@@ -62,3 +62,38 @@ GrB_Matrix msbfs(GrB_Matrix A, const std::vector<GrB_Index> &sources)
     GrB_Matrix_free(&visited);
     return parent;
 }
+
+GrB_Matrix msbfs_levels(GrB_Matrix A, const std::vector<GrB_Index> &sources)
+{
+    GrB_Index n;
+    GrB_Matrix_nrows(&n, A);
+    GrB_Index nsrc = sources.size();
+
+    GrB_Matrix front, levels;
+    GrB_Matrix_new(&front, GrB_BOOL, nsrc, n);
+    GrB_Matrix_new(&levels, GrB_INT32, nsrc, n);
+
+    for (GrB_Index i = 0; i < nsrc; ++i)
+    {
+        GrB_Matrix_setElement_BOOL(front, true, i, sources[i]);
+        GrB_Matrix_setElement_INT32(levels, 0, i, sources[i]);
+    }
+
+    for (int32_t level = 1;; ++level)
+    {
+        // front<!levels, replace> = front * A, only the structure is needed
+        GrB_mxm(front, levels, GrB_NULL, GxB_ANY_PAIR_BOOL, front, A, GrB_DESC_RSC);
+
+        GrB_Index nvals;
+        GrB_Matrix_nvals(&nvals, front);
+        if (nvals == 0)
+        {
+            break;
+        }
+
+        // levels<front> = level
+        GrB_Matrix_assign_INT32(levels, front, GrB_NULL, level, GrB_ALL, nsrc, GrB_ALL, n, GrB_DESC_S);
+    }
+    GrB_Matrix_free(&front);
+    return levels;
+}
@@ -4,3 +4,7 @@
 
 
 GrB_Matrix msbfs(GrB_Matrix A, const std::vector<GrB_Index>& sources);
+
+// Same traversal as msbfs, but stores BFS levels (INT32, sources at level 0)
+// instead of parents. Unreached vertices have no entry.
+GrB_Matrix msbfs_levels(GrB_Matrix A, const std::vector<GrB_Index>& sources);
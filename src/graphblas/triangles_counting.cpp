@@ -42,15 +42,21 @@ namespace tc_graphblas
         return triangles_counting(A, true);
     }
 
-    std::vector<double> benchmark(const char *filename, bool triangular, const int num_iters)
+    std::vector<double> benchmark(const char *filename, bool triangular, const int num_iters,
+                                  int nthreads, bool first_touch)
     {
         std::vector<double> iteration_times;
         iteration_times.reserve(num_iters);
 
         GrB_init(GrB_NONBLOCKING);
+        graphblas_utils::set_num_threads(nthreads);
 
         GrB_Matrix A;
         A = graphblas_utils::load_graph(filename, triangular);
+        if (first_touch)
+        {
+            graphblas_utils::first_touch_copy(&A);
+        }
 
         for (int i = 0; i < num_iters; ++i)
         {
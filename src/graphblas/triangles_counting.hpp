@@ -11,5 +11,6 @@ namespace tc_graphblas
 
     uint64_t sandia(GrB_Matrix A);
 
-    std::vector<double> benchmark(const char *filename, bool triangular, const int num_iters);
+    std::vector<double> benchmark(const char *filename, bool triangular, const int num_iters,
+                                  int nthreads = 0, bool first_touch = false);
 }
\ No newline at end of file
@@ -111,4 +111,22 @@ namespace graphblas_utils
         }
     }
 
+    void set_num_threads(int nthreads)
+    {
+        if (nthreads > 0)
+        {
+            GxB_Global_Option_set(GxB_NTHREADS, nthreads);
+        }
+    }
+
+    void first_touch_copy(GrB_Matrix *A)
+    {
+        GrB_Matrix_wait(*A, GrB_MATERIALIZE);
+        GrB_Matrix copy;
+        GrB_Matrix_dup(&copy, *A);
+        GrB_Matrix_wait(copy, GrB_MATERIALIZE);
+        GrB_Matrix_free(A);
+        *A = copy;
+    }
+
 }
\ No newline at end of file
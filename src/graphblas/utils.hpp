@@ -10,4 +10,11 @@ namespace graphblas_utils
     GrB_Matrix load_graph(const std::string &filepath, bool triangular);
 
     void print_matrix(GrB_Matrix A);
+
+    // Sets GxB_NTHREADS, must be called after GrB_init. 0 keeps the default.
+    void set_num_threads(int nthreads);
+
+    // Replaces *A with a copy made by the current GraphBLAS threads, so the
+    // pages of the matrix are first touched by the threads that will use them.
+    void first_touch_copy(GrB_Matrix *A);
 }
\ No newline at end of file
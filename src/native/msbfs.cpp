@@ -0,0 +1,25 @@
+#include "msbfs.hpp"
+
+namespace msbfs_native
+{
+    template <typename Visit>
+    static Result run(const native_utils::Graph &A, const std::vector<uint64_t> &sources)
+    {
+        return std::visit([&](const auto &csr) -> Result
+                          {
+                              using Index = std::decay_t<decltype(csr.cols[0])>;
+                              std::vector<Index> narrow(sources.begin(), sources.end());
+                              return msbfs<Index, Visit>(csr, narrow); },
+                          A);
+    }
+
+    Result msbfs(const native_utils::Graph &A, const std::vector<uint64_t> &sources)
+    {
+        return run<AnySecondI>(A, sources);
+    }
+
+    Result msbfs_levels(const native_utils::Graph &A, const std::vector<uint64_t> &sources)
+    {
+        return run<Level>(A, sources);
+    }
+}
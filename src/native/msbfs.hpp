@@ -0,0 +1,198 @@
+#pragma once
+#include "utils.hpp"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace msbfs_native
+{
+    // ANY.SECONDI as in the GraphBLAS msbfs: a newly reached vertex stores the
+    // frontier vertex it was reached from, a source stores itself.
+    struct AnySecondI
+    {
+        template <typename Index>
+        static constexpr Index source(Index s)
+        {
+            return s;
+        }
+
+        template <typename Index>
+        static constexpr Index visit(Index u, Index)
+        {
+            return u;
+        }
+    };
+
+    // BFS level instead of parent, sources are at level 0
+    struct Level
+    {
+        template <typename Index>
+        static constexpr Index source(Index)
+        {
+            return 0;
+        }
+
+        template <typename Index>
+        static constexpr Index visit(Index, Index level)
+        {
+            return level;
+        }
+    };
+
+    template <typename Index>
+    constexpr Index UNREACHED = std::numeric_limits<Index>::max();
+
+    // Multi-source BFS with one bit per source, 64 sources per pass, direction
+    // optimizing as in Beamer et al.: small frontiers are pushed top-down
+    // (claiming bits of the next frontier with an atomic or), large ones are
+    // pulled bottom-up (every unvisited vertex scans its neighbours). Result is
+    // nsrc x n row major, UNREACHED where a source does not reach the vertex.
+    // The result and per-vertex state are filled by static-schedule threads, so
+    // under first touch their pages follow the thread count like the graph.
+    template <typename Index, typename Visit = AnySecondI>
+    native_utils::Array<Index> msbfs(const native_utils::CSR<Index> &A, const std::vector<Index> &sources)
+    {
+        using Word = uint64_t;
+        // Switch to bottom-up once the frontier touches more than 1/ALPHA of the edges
+        const std::size_t ALPHA = 14;
+        const std::size_t PARALLEL_EDGES = 4096;
+        const int64_t n = A.n;
+        const std::size_t stride = A.n;
+        const std::size_t m = A.cols.size();
+        const Index *cols = A.cols.data();
+        const Index *offsets = A.offsets.data();
+
+        native_utils::Array<Index> result(sources.size() * stride);
+        native_utils::Array<Word> seen(n), front(n), next(n);
+        native_utils::parallel_fill(result, UNREACHED<Index>);
+        std::vector<Index> frontier, next_frontier;
+
+        for (std::size_t base = 0; base < sources.size(); base += 64)
+        {
+            const std::size_t nsrc = std::min<std::size_t>(64, sources.size() - base);
+            Index *out = result.data() + base * stride;
+            native_utils::parallel_fill(seen, Word(0));
+            native_utils::parallel_fill(front, Word(0));
+            native_utils::parallel_fill(next, Word(0));
+            frontier.clear();
+            for (std::size_t i = 0; i < nsrc; ++i)
+            {
+                const Index s = sources[base + i];
+                if (front[s] == 0)
+                {
+                    frontier.push_back(s);
+                }
+                seen[s] |= Word(1) << i;
+                front[s] |= Word(1) << i;
+                out[i * stride + s] = Visit::source(s);
+            }
+            const Word all = nsrc == 64 ? ~Word(0) : (Word(1) << nsrc) - 1;
+
+            for (Index level = 1; !frontier.empty(); ++level)
+            {
+                std::size_t frontier_edges = 0;
+                for (Index u : frontier)
+                {
+                    frontier_edges += offsets[u + 1] - offsets[u];
+                }
+                const bool bottom_up = frontier_edges * ALPHA > m;
+                // Narrow frontiers of high-diameter graphs are cheaper without any thread sync
+                [[maybe_unused]] const bool parallel = bottom_up || frontier_edges > PARALLEL_EDGES;
+                next_frontier.clear();
+
+#pragma omp parallel if (parallel)
+                {
+                    std::vector<Index> local;
+                    if (bottom_up)
+                    {
+#pragma omp for schedule(dynamic, 1024) nowait
+                        for (int64_t v = 0; v < n; ++v)
+                        {
+                            const Word unseen = ~seen[v] & all;
+                            Word found = 0;
+                            for (Index k = offsets[v]; unseen != found && k < offsets[v + 1]; ++k)
+                            {
+                                const Index u = cols[k];
+                                Word add = front[u] & unseen & ~found;
+                                found |= add;
+                                while (add != 0)
+                                {
+                                    out[std::size_t(std::countr_zero(add)) * stride + v] = Visit::visit(u, level);
+                                    add &= add - 1;
+                                }
+                            }
+                            if (found != 0)
+                            {
+                                next[v] = found;
+                                local.push_back(v);
+                            }
+                        }
+                    }
+                    else
+                    {
+                        const int64_t nfront = frontier.size();
+#pragma omp for schedule(dynamic, 64) nowait
+                        for (int64_t f = 0; f < nfront; ++f)
+                        {
+                            const Index u = frontier[f];
+                            for (Index k = offsets[u]; k < offsets[u + 1]; ++k)
+                            {
+                                const Index v = cols[k];
+                                const Word add = front[u] & ~seen[v] & all;
+                                if (add == 0)
+                                {
+                                    continue;
+                                }
+                                // Each bit is claimed by exactly one thread, which writes its parent
+                                const Word old = std::atomic_ref<Word>(next[v]).fetch_or(add);
+                                Word claimed = add & ~old;
+                                if (old == 0)
+                                {
+                                    local.push_back(v);
+                                }
+                                while (claimed != 0)
+                                {
+                                    out[std::size_t(std::countr_zero(claimed)) * stride + v] = Visit::visit(u, level);
+                                    claimed &= claimed - 1;
+                                }
+                            }
+                        }
+                    }
+#pragma omp critical
+                    next_frontier.insert(next_frontier.end(), local.begin(), local.end());
+#pragma omp barrier
+
+                    const int64_t nnext = next_frontier.size();
+                    const int64_t nfront = frontier.size();
+#pragma omp for schedule(static) nowait
+                    for (int64_t f = 0; f < nnext; ++f)
+                    {
+                        seen[next_frontier[f]] |= next[next_frontier[f]];
+                    }
+#pragma omp for schedule(static) nowait
+                    for (int64_t f = 0; f < nfront; ++f)
+                    {
+                        front[frontier[f]] = 0;
+                    }
+                }
+
+                // front is all zero now and becomes the next "next"
+                std::swap(front, next);
+                std::swap(frontier, next_frontier);
+            }
+        }
+        return result;
+    }
+
+    using Result = std::variant<native_utils::Array<uint32_t>, native_utils::Array<uint64_t>>;
+
+    // Run msbfs on the width the graph was loaded with, storing parents or levels
+    Result msbfs(const native_utils::Graph &A, const std::vector<uint64_t> &sources);
+
+    Result msbfs_levels(const native_utils::Graph &A, const std::vector<uint64_t> &sources);
+}
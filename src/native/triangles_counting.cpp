@@ -0,0 +1,81 @@
+#include "triangles_counting.hpp"
+#include <chrono>
+#include <iostream>
+#include <algorithm>
+#include <limits>
+
+namespace tc_native
+{
+    uint64_t triangles_counting(const native_utils::Graph &A, bool triangular)
+    {
+        uint64_t sum = std::visit([](const auto &csr) -> uint64_t
+                                  {
+                                      // Every edge adds at most max_degree, so nnz * max_degree
+                                      // bounds the sum and picks the narrowest count type
+                                      uint64_t max_degree = 0;
+                                      for (uint64_t u = 0; u < csr.n; ++u)
+                                      {
+                                          max_degree = std::max<uint64_t>(max_degree, csr.offsets[u + 1] - csr.offsets[u]);
+                                      }
+                                      if (max_degree == 0 || csr.cols.size() <= std::numeric_limits<uint32_t>::max() / max_degree)
+                                      {
+                                          return masked_dot_reduce<uint32_t, PlusPair<uint32_t>>(csr);
+                                      }
+                                      return masked_dot_reduce<uint64_t, PlusPair<uint64_t>>(csr); },
+                                  A);
+
+        if (!triangular && sum % 6 != 0)
+        {
+            std::cerr << "Warning: triangle count is not multiple of 6 in Burkhardt algorithm" << std::endl;
+        }
+
+        return triangular ? sum : sum / 6;
+    }
+
+    uint64_t burkhardt(const native_utils::Graph &A)
+    {
+        return triangles_counting(A, false);
+    }
+
+    uint64_t sandia(const native_utils::Graph &A)
+    {
+        return triangles_counting(A, true);
+    }
+
+    std::vector<double> benchmark(const char *filename, bool triangular, const int num_iters, int &index_width,
+                                  bool first_touch)
+    {
+        std::vector<double> iteration_times;
+        iteration_times.reserve(num_iters);
+
+        native_utils::Graph A = native_utils::load_graph(filename, triangular);
+        index_width = native_utils::index_width(A);
+        if (first_touch)
+        {
+            native_utils::first_touch_copy(A);
+        }
+
+        for (int i = 0; i < num_iters; ++i)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+            uint64_t answer;
+            if (triangular)
+            {
+                answer = sandia(A);
+            }
+            else
+            {
+                answer = burkhardt(A);
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+
+            std::chrono::duration<double> elapsed = end - start;
+
+            std::cout << (triangular ? "NATIVE_Sandia" : "NATIVE_Burkhardt")
+                      << " (" << index_width << "-bit) Iteration " << i + 1 << ": " << elapsed.count() << " s" << std::endl;
+            iteration_times.push_back(elapsed.count());
+        }
+
+        return iteration_times;
+    }
+}
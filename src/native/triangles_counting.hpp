@@ -0,0 +1,86 @@
+#pragma once
+#include "utils.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace tc_native
+{
+    // PLUS.PAIR: every common neighbour contributes 1
+    template <typename Count>
+    struct PlusPair
+    {
+        static constexpr Count zero = 0;
+
+        static constexpr Count add(Count a, Count b)
+        {
+            return a + b;
+        }
+
+        template <typename Index>
+        static constexpr Count mul(Index, Index)
+        {
+            return 1;
+        }
+    };
+
+    // Reduce of C<A> = A * A for a symmetric or upper triangular A: every
+    // edge (u, v) adds the semiring dot of rows u and v, found by merging the
+    // two sorted rows. Semiring is a compile-time functor so the merge loop
+    // is fully inlined for each index / count width.
+    template <typename Count, typename Semiring, typename Index>
+    Count masked_dot_reduce(const native_utils::CSR<Index> &A)
+    {
+        const Index *cols = A.cols.data();
+        const Index *offsets = A.offsets.data();
+        const int64_t n = A.n;
+
+        Count total = Semiring::zero;
+#pragma omp parallel
+        {
+            Count local = Semiring::zero;
+#pragma omp for schedule(dynamic, 256) nowait
+            for (int64_t u = 0; u < n; ++u)
+            {
+                const Index *u_begin = cols + offsets[u];
+                const Index *u_end = cols + offsets[u + 1];
+                for (const Index *e = u_begin; e != u_end; ++e)
+                {
+                    const Index *a = u_begin;
+                    const Index *b = cols + offsets[*e];
+                    const Index *b_end = cols + offsets[*e + 1];
+                    while (a != u_end && b != b_end)
+                    {
+                        if (*a < *b)
+                        {
+                            ++a;
+                        }
+                        else if (*b < *a)
+                        {
+                            ++b;
+                        }
+                        else
+                        {
+                            local = Semiring::add(local, Semiring::template mul<Index>(*a, *b));
+                            ++a;
+                            ++b;
+                        }
+                    }
+                }
+            }
+#pragma omp critical
+            total = Semiring::add(total, local);
+        }
+        return total;
+    }
+
+    uint64_t triangles_counting(const native_utils::Graph &A, bool triangular);
+
+    uint64_t burkhardt(const native_utils::Graph &A);
+
+    uint64_t sandia(const native_utils::Graph &A);
+
+    // index_width is set to the width the loader picked for the dataset,
+    // first_touch copies the graph with the current OpenMP threads
+    std::vector<double> benchmark(const char *filename, bool triangular, const int num_iters, int &index_width,
+                                  bool first_touch = false);
+}
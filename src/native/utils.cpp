@@ -0,0 +1,115 @@
+#include "utils.hpp"
+#include <stdexcept>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <limits>
+
+namespace native_utils
+{
+    template <typename Index>
+    static CSR<Index> build(uint64_t n, const std::vector<std::pair<uint64_t, uint64_t>> &arcs)
+    {
+        CSR<Index> A;
+        A.n = static_cast<Index>(n);
+        A.offsets.assign(n + 1, 0);
+        A.cols.resize(arcs.size());
+        for (const auto &[u, v] : arcs)
+        {
+            ++A.offsets[u + 1];
+        }
+        for (uint64_t u = 0; u < n; ++u)
+        {
+            A.offsets[u + 1] += A.offsets[u];
+        }
+        // arcs are sorted, so every row comes out sorted
+        for (std::size_t k = 0; k < arcs.size(); ++k)
+        {
+            A.cols[k] = static_cast<Index>(arcs[k].second);
+        }
+        return A;
+    }
+
+    Graph load_graph(const std::string &filepath, bool triangular)
+    {
+        std::ifstream infile(filepath);
+        if (!infile.is_open())
+            throw std::runtime_error("Cannot open file: " + filepath);
+        uint64_t nrows = 0, ncols = 0, n_lines = 0;
+        std::string header;
+        if (!std::getline(infile, header))
+            throw std::runtime_error("File is empty: " + filepath);
+        std::istringstream hss(header);
+        if (!(hss >> nrows >> ncols >> n_lines))
+            throw std::runtime_error("Header format error in file: " + filepath);
+        std::vector<std::pair<uint64_t, uint64_t>> arcs;
+        arcs.reserve(2 * n_lines);
+        std::string line;
+        for (uint64_t i = 0; i < n_lines; ++i)
+        {
+            if (!std::getline(infile, line))
+                throw std::runtime_error("Not enough edge lines in file: " + filepath);
+            std::istringstream iss(line);
+            uint64_t u, v;
+            if (!(iss >> u >> v))
+                continue;
+            if (u == 0 || v == 0 || u > nrows || v > nrows)
+                throw std::runtime_error("Vertex id out of range in file: " + filepath);
+            --u;
+            --v;
+            if (!triangular)
+            {
+                arcs.emplace_back(u, v);
+                arcs.emplace_back(v, u); // undirected
+            }
+            else if (u != v)
+            {
+                arcs.emplace_back(std::min(u, v), std::max(u, v));
+            }
+        }
+        infile.close();
+        std::sort(arcs.begin(), arcs.end());
+        arcs.erase(std::unique(arcs.begin(), arcs.end()), arcs.end());
+
+        // max() is reserved as the unreached marker of msbfs_native
+        const uint64_t narrow_max = std::numeric_limits<uint32_t>::max();
+        if (nrows < narrow_max && arcs.size() <= narrow_max)
+        {
+            return build<uint32_t>(nrows, arcs);
+        }
+        return build<uint64_t>(nrows, arcs);
+    }
+
+    template <typename Index>
+    static CSR<Index> parallel_copy(const CSR<Index> &A)
+    {
+        CSR<Index> B;
+        B.n = A.n;
+        B.offsets.resize(A.offsets.size());
+        B.cols.resize(A.cols.size());
+        B.offsets[0] = A.offsets[0];
+        const int64_t n = A.n;
+#pragma omp parallel for schedule(static)
+        for (int64_t u = 0; u < n; ++u)
+        {
+            B.offsets[u + 1] = A.offsets[u + 1];
+            std::copy(A.cols.begin() + A.offsets[u], A.cols.begin() + A.offsets[u + 1],
+                      B.cols.begin() + A.offsets[u]);
+        }
+        return B;
+    }
+
+    void first_touch_copy(Graph &A)
+    {
+        std::visit([](auto &csr)
+                   { csr = parallel_copy(csr); },
+                   A);
+    }
+
+    int index_width(const Graph &A)
+    {
+        return std::visit([](const auto &csr)
+                          { return static_cast<int>(8 * sizeof(csr.cols[0])); },
+                          A);
+    }
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace native_utils
+{
+    // Leaves resized elements uninitialized, so pages are placed by whichever
+    // thread writes them first instead of the one that allocated them.
+    template <typename T>
+    struct DefaultInitAllocator : std::allocator<T>
+    {
+        template <typename U>
+        struct rebind
+        {
+            using other = DefaultInitAllocator<U>;
+        };
+
+        DefaultInitAllocator() = default;
+
+        template <typename U>
+        DefaultInitAllocator(const DefaultInitAllocator<U> &) noexcept {}
+
+        template <typename U>
+        void construct(U *p)
+        {
+            ::new (static_cast<void *>(p)) U;
+        }
+
+        template <typename U, typename... Args>
+        void construct(U *p, Args &&...args)
+        {
+            ::new (static_cast<void *>(p)) U(std::forward<Args>(args)...);
+        }
+    };
+
+    template <typename T>
+    using Array = std::vector<T, DefaultInitAllocator<T>>;
+
+    // Fills a with static-schedule OpenMP threads, the same split the
+    // kernels' static loops use
+    template <typename T>
+    void parallel_fill(Array<T> &a, T value)
+    {
+        const int64_t size = a.size();
+        T *data = a.data();
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < size; ++i)
+        {
+            data[i] = value;
+        }
+    }
+
+    // Compressed sparse rows, column ids sorted and unique inside every row
+    template <typename Index>
+    struct CSR
+    {
+        Index n = 0;
+        Array<Index> offsets;
+        Array<Index> cols;
+    };
+
+    // Every loaded graph is stored with the narrowest index type holding its
+    // vertex ids (plus the "unreached" sentinel) and edge offsets.
+    using Graph = std::variant<CSR<uint32_t>, CSR<uint64_t>>;
+
+    // Same file format and edge set as graphblas_utils::load_graph:
+    // symmetric, or strict upper triangle when triangular.
+    Graph load_graph(const std::string &filepath, bool triangular);
+
+    int index_width(const Graph &A);
+
+    // Replaces A with a copy written row by row by the current OpenMP threads
+    // (static schedule), so every block of rows and its columns is first
+    // touched by the thread that will use it. Counterpart of
+    // graphblas_utils::first_touch_copy.
+    void first_touch_copy(Graph &A);
+}
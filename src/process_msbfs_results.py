@@ -1,6 +1,7 @@
 import pandas as pd
 import matplotlib.pyplot as plt
 import numpy as np
+from scaling_results import scaling_table, print_scaling_table, plot_scaling
 
 def plot_dataset_groups_with_pairs(df, output='msbfs_grouped_pairs.png', normalize_by_nstart=False):
     # Identify all unique algos and sort for consistent color/legend
@@ -84,6 +85,14 @@ def plot_dataset_groups_with_pairs(df, output='msbfs_grouped_pairs.png', normali
 # Integrate into main run
 def main():
     df = pd.read_csv('msbfs_bench.csv')
+    keys = ['algo', 'dataset', 'n_start_vert']
+    scaling = scaling_table(df, keys, 'time')
+    if scaling is not None:
+        print_scaling_table(scaling, keys)
+        scaling.to_csv('msbfs_scaling.csv', index=False)
+        plot_scaling(scaling, keys, 'msbfs_scaling')
+        # Bar plots below compare libraries at the largest thread count
+        df = df[(df['threads'] == df['threads'].max()) | (df['threads'] == 0)]
     plot_dataset_groups_with_pairs(df)
     plot_dataset_groups_with_pairs(df, output='msbfs_grouped_pairs_norm.png', normalize_by_nstart=True)
 
@@ -2,6 +2,7 @@ import pandas as pd
 import matplotlib.pyplot as plt
 import numpy as np
 import math
+from scaling_results import scaling_table, print_scaling_table, plot_scaling
 
 def plot_category(df, category, algos, output):
     # Filter by category
@@ -106,8 +107,16 @@ def plot_grouped_by_algo_lib(df, output, log_y=True):
 
 def main():
     df = pd.read_csv('./bench_tc.csv')
-    burkhardt_algos = ['GB_Burkhardt', 'SPLA_Burkhardt', 'SPLAGPU_Burkhardt']
-    sandia_algos = ['GB_Sandia', 'SPLA_Sandia', 'SPLAGPU_Sandia']
+    keys = ['algo', 'dataset']
+    scaling = scaling_table(df, keys, 'time_of_iter')
+    if scaling is not None:
+        print_scaling_table(scaling, keys)
+        scaling.to_csv('tc_scaling.csv', index=False)
+        plot_scaling(scaling, keys, 'tc_scaling')
+        # Bar plots below compare libraries at the largest thread count
+        df = df[(df['threads'] == df['threads'].max()) | (df['threads'] == 0)]
+    burkhardt_algos = ['GB_Burkhardt', 'SPLA_Burkhardt', 'SPLAGPU_Burkhardt', 'NATIVE_Burkhardt']
+    sandia_algos = ['GB_Sandia', 'SPLA_Sandia', 'SPLAGPU_Sandia', 'NATIVE_Sandia']
     plot_category(df, 'Burkhardt', burkhardt_algos, 'burkhardt_bar.png')
     plot_category(df, 'Sandia', sandia_algos, 'sandia_bar.png')
     plot_grouped_by_algo_lib(df, 'grouped_by_algo_lib.png')
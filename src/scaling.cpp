@@ -0,0 +1,128 @@
+#include "scaling.hpp"
+#include <stdexcept>
+#include <sstream>
+#include <iostream>
+#include <thread>
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#ifdef HAVE_LIBNUMA
+#include <numa.h>
+#include <sched.h>
+#endif
+
+namespace scaling
+{
+    NumaPolicy parse_numa_policy(const std::string &name)
+    {
+        if (name == "default")
+            return NumaPolicy::Default;
+        if (name == "interleave")
+            return NumaPolicy::Interleave;
+        if (name == "local")
+            return NumaPolicy::Local;
+        if (name == "first_touch")
+            return NumaPolicy::FirstTouch;
+        throw std::runtime_error("Unknown NUMA policy: " + name);
+    }
+
+    std::string to_string(NumaPolicy policy)
+    {
+        switch (policy)
+        {
+        case NumaPolicy::Interleave:
+            return "interleave";
+        case NumaPolicy::Local:
+            return "local";
+        case NumaPolicy::FirstTouch:
+            return "first_touch";
+        default:
+            return "default";
+        }
+    }
+
+    void apply_numa_policy(NumaPolicy policy)
+    {
+        if (policy == NumaPolicy::Default)
+        {
+            return;
+        }
+#ifdef HAVE_LIBNUMA
+        if (numa_available() < 0)
+        {
+            std::cerr << "Warning: NUMA is not available, policy " << to_string(policy) << " ignored" << std::endl;
+            return;
+        }
+        switch (policy)
+        {
+        case NumaPolicy::Interleave:
+            numa_set_interleave_mask(numa_all_nodes_ptr);
+            break;
+        case NumaPolicy::Local:
+            numa_run_on_node(numa_node_of_cpu(sched_getcpu()));
+            numa_set_localalloc();
+            break;
+        default:
+            // First touch is the kernel default, the matrix copy is done by the benchmarks.
+            numa_set_localalloc();
+            break;
+        }
+#else
+        if (policy != NumaPolicy::FirstTouch)
+        {
+            std::cerr << "Warning: built without libnuma, policy " << to_string(policy) << " ignored" << std::endl;
+        }
+#endif
+    }
+
+    std::vector<int> parse_thread_list(const std::string &list)
+    {
+        std::vector<int> threads;
+        std::istringstream ss(list);
+        std::string item;
+        while (std::getline(ss, item, ','))
+        {
+            int n = std::stoi(item);
+            if (n <= 0)
+                throw std::runtime_error("Thread count must be positive: " + item);
+            threads.push_back(n);
+        }
+        if (threads.empty())
+            throw std::runtime_error("Empty thread list: " + list);
+        return threads;
+    }
+
+    static int default_threads()
+    {
+#ifdef _OPENMP
+        static const int n = omp_get_max_threads();
+#else
+        static const int n = std::max(1u, std::thread::hardware_concurrency());
+#endif
+        return n;
+    }
+
+    void set_num_threads(int nthreads)
+    {
+        // Remember the library default before the first override.
+        default_threads();
+#ifdef _OPENMP
+        omp_set_num_threads(effective_threads(nthreads));
+#endif
+    }
+
+    int effective_threads(int nthreads)
+    {
+        return nthreads > 0 ? nthreads : default_threads();
+    }
+
+    int native_threads(int nthreads)
+    {
+#ifdef _OPENMP
+        return effective_threads(nthreads);
+#else
+        return 1;
+#endif
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <string>
+#include <vector>
+
+namespace scaling
+{
+    // Memory placement used for a sweep run.
+    // default     → leave the kernel policy untouched
+    // interleave  → interleave pages of every allocation across all nodes
+    // local       → pin threads and memory to the node the process starts on
+    // first_touch → after loading, copy the matrix with the sweep's thread
+    //               count so its pages land on the nodes of the worker threads
+    enum class NumaPolicy
+    {
+        Default,
+        Interleave,
+        Local,
+        FirstTouch
+    };
+
+    NumaPolicy parse_numa_policy(const std::string &name);
+
+    std::string to_string(NumaPolicy policy);
+
+    // Applies the policy to the whole process, call before loading any graph.
+    void apply_numa_policy(NumaPolicy policy);
+
+    // Parses a comma separated list like "1,2,4,8".
+    std::vector<int> parse_thread_list(const std::string &list);
+
+    // Sets the OpenMP thread count, 0 keeps the default.
+    void set_num_threads(int nthreads);
+
+    // Thread count actually used when `nthreads` is requested.
+    int effective_threads(int nthreads);
+
+    // Thread count of the native kernels, which run serially when the
+    // benchmarks are built without OpenMP.
+    int native_threads(int nthreads);
+}
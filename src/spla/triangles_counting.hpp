@@ -2,12 +2,13 @@
 #include <spla.hpp>
 #include <vector>
 #include <string>
+#include <cstdint>
 
 namespace tc_spla
 {
     using namespace spla;
     std::vector<double> benchmark(const char *filename, bool triangular, int num_runs, bool accelerated);
 
-    void burkhardt(int &ntrins, const ref_ptr<Matrix> &A, const ref_ptr<Matrix> &B);
-    void sandia(int &ntrins, const ref_ptr<Matrix> &A, const ref_ptr<Matrix> &B);
+    void burkhardt(int64_t &ntrins, const ref_ptr<Matrix> &A, const ref_ptr<Matrix> &B);
+    void sandia(int64_t &ntrins, const ref_ptr<Matrix> &A, const ref_ptr<Matrix> &B);
 }
\ No newline at end of file